@@ -5,12 +5,15 @@ First version: 12 of August, 2024
 Description: This Project was made in order to test out tree functions and store, destination, weight and valuation of parcels in a hash table.
 The program reads a file with the parcels and stores them in a hash table, then the user can choose to display parcels by country, search parcels by weight, display total weight and valuation for a country, display the cheapest and most expensive parcels for a country, display the lightest and heaviest parcels for a country, and exit the application.
 The program uses a hash table to store the parcels and a binary search tree to store the parcels for each country.
+Country names are also indexed in a radix trie so they can be looked up ignoring case or listed by prefix.
+Parcels of a country can also be paged through in order of weight with a cursor that resumes from a continuation token.
 Github: https://github.com/comet400/Data-Structures-Project.git
 */
 
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <ctype.h>
 
 #define TABLE_SIZE 127 // Prime number for hash table size
 #define MAX_STRING 21 // Maximum string length
@@ -36,14 +39,36 @@ int calculateTotalWeight(struct TreeNode* root);
 void freeMemory(struct TreeNode* root);
 void initializeHashTable(struct HashTable* table);
 void insertParcel(struct HashTable* table, struct Parcel* parcel);
-void displayParcels(struct HashTable* table, const char* country);
-void searchWeightForCountry(struct HashTable* table, const char* country, int weight);
-void displayTotalForCountry(struct HashTable* table, const char* country);
-void displayCheapestMostExpensive(struct HashTable* table, const char* country);
-void displayLightestHeaviest(struct HashTable* table, const char* country);
+void displayParcels(struct HashTable* table, const char* country, unsigned long index);
+void searchWeightForCountry(struct HashTable* table, const char* country, unsigned long index, int weight);
+void displayTotalForCountry(struct HashTable* table, const char* country, unsigned long index);
+void displayCheapestMostExpensive(struct HashTable* table, const char* country, unsigned long index);
+void displayLightestHeaviest(struct HashTable* table, const char* country, unsigned long index);
 void loadParcelsFromFile(struct HashTable* table, const char* filename);
 void displayMenu(struct HashTable* table);
-TreeNode* searchParcel(TreeNode* root, const char* destination);
+struct TrieNode* createTrieNode(const char* edge, int edgeLength);
+int insertCountry(struct TrieNode* root, const char* name, unsigned long index);
+struct TrieNode* descendTrie(struct TrieNode* root, const char* key, int allowPartial);
+struct CountryName* findCountryExact(struct TrieNode* root, const char* name);
+struct CountryName* findCountryIgnoreCase(struct TrieNode* root, const char* name);
+int listCountriesWithPrefix(struct TrieNode* root, const char* prefix, void (*visit)(struct CountryName* country));
+int visitTrie(struct TrieNode* node, void (*visit)(struct CountryName* country));
+void printCountry(struct CountryName* country);
+void trimWhitespace(char* text);
+int resolveCountry(struct HashTable* table, const char* input, struct CountryName** first);
+int slotShownBefore(struct CountryName* first, struct CountryName* country);
+void freeTrie(struct TrieNode* root);
+int openCursor(struct ParcelCursor* cursor, struct HashTable* table, const char* country, unsigned long index);
+int openCursorAt(struct ParcelCursor* cursor, struct HashTable* table, const char* country, unsigned long index, struct CursorToken token);
+int pushCursor(struct ParcelCursor* cursor, struct TreeNode* node);
+int seekCursor(struct ParcelCursor* cursor, int weight);
+struct Parcel* peekParcel(struct ParcelCursor* cursor);
+int nextNode(struct ParcelCursor* cursor);
+struct Parcel* nextParcel(struct ParcelCursor* cursor);
+void advanceToken(struct CursorToken* token, struct Parcel* parcel);
+int resumeCursor(struct ParcelCursor* cursor, struct CursorToken token);
+void closeCursor(struct ParcelCursor* cursor);
+int displayParcelPage(struct HashTable* table, const char* country, unsigned long index, struct CursorToken* token, int offset, int limit, int* more);
 
 struct Parcel // Parcel structure
 {
@@ -59,9 +84,42 @@ struct TreeNode // Tree node structure for BST
     struct TreeNode* right; // Right child
 };
 
+struct CountryName // Spelling of a country name as loaded from the file
+{
+    char* name; // Country name as loaded
+    unsigned long index; // Hash table index of the country
+    struct CountryName* next; // Next spelling of the same name, in load order
+};
+
+struct TrieNode // Node of the radix trie indexing country names
+{
+    char* edge; // Lowercase label of the edge leading into this node
+    int edgeLength; // Length of the edge label
+    struct CountryName* names; // Spellings of the name ending here, NULL if no name ends here
+    struct TrieNode* child; // First child, children are sorted by first letter
+    struct TrieNode* sibling; // Next sibling
+};
+
+struct ParcelCursor // Cursor over the parcels of a country, in order of weight
+{
+    struct TreeNode* root; // Tree of the hash slot holding the country
+    const char* country; // Only parcels for this country are returned
+    struct TreeNode** stack; // Nodes left to visit, the top one holds the next parcel
+    int depth; // Number of nodes on the stack
+    int capacity; // Size of the stack. It grows with the height of the tree, which is the number of parcels when they were loaded in weight order
+    int failed; // Set when the stack could not grow, the cursor then stops early
+};
+
+struct CursorToken // Where to continue a paginated listing
+{
+    int weight; // Weight of the last parcel returned, or the minimum weight before the first page
+    int skip; // Number of parcels already returned at that weight
+};
+
 struct HashTable // Hash table structure
 {
     struct TreeNode* table[TABLE_SIZE];
+    struct TrieNode* countries; // Radix trie of the country names in the table
 };
 
 /* Function: createParcel
@@ -321,6 +379,7 @@ void initializeHashTable(struct HashTable* table) // Initialize the hash table
     {
         table->table[i] = NULL; // Set each element to NULL
     }
+    table->countries = createTrieNode("", 0); // Create the empty root of the country index
 }
 
 /* Function: insertParcel
@@ -333,16 +392,16 @@ void insertParcel(struct HashTable* table, struct Parcel* parcel) // Insert a pa
     unsigned long index = hashFunction(parcel->destination); // Get the hash value
 
     table->table[index] = insertNode(table->table[index], parcel); // Insert the parcel into the BST
+    insertCountry(table->countries, parcel->destination, index); // Index the country name
 }
 
 /* Function: displayParcels
-* Parameters : struct HashTable* table, const char* country
+* Parameters : struct HashTable* table, const char* country, unsigned long index
 * Description : displays parcels for a given country
 * Return value : void
 */
-void displayParcels(struct HashTable* table, const char* country) // Display parcels for a given country
+void displayParcels(struct HashTable* table, const char* country, unsigned long index) // Display parcels for a given country
 {
-    unsigned long index = hashFunction(country); // Get the hash value
     printf("Parcels for %s:\n", country); // Print the country name
     if (table->table[index] != NULL)
     {
@@ -351,13 +410,12 @@ void displayParcels(struct HashTable* table, const char* country) // Display par
 }
 
 /* Function: searchWeightForCountry
-* Parameters : struct HashTable* table, const char* country, int weight, int isHigher
+* Parameters : struct HashTable* table, const char* country, unsigned long index, int weight
 * Description : searches for parcels by weight for a given country
 * Return value : void
 */
-void searchWeightForCountry(struct HashTable* table, const char* country, int weight)
+void searchWeightForCountry(struct HashTable* table, const char* country, unsigned long index, int weight)
 {
-    unsigned long index = hashFunction(country); // Get the hash value
 	printf("\nParcels with weight higher than %d for %s:\n", weight, country); // Print the country name
 	if (table->table[index] != NULL)
 	{
@@ -379,13 +437,12 @@ void searchWeightForCountry(struct HashTable* table, const char* country, int we
 }
 
 /* Function: displayTotalForCountry
-* Parameters : struct HashTable* table, const char* country
+* Parameters : struct HashTable* table, const char* country, unsigned long index
 * Description : displays the total weight and valuation for a given country
 * Return value : void
 */
-void displayTotalForCountry(struct HashTable* table, const char* country) // Display the total weight and valuation for a given country
+void displayTotalForCountry(struct HashTable* table, const char* country, unsigned long index) // Display the total weight and valuation for a given country
 {
-    unsigned long index = hashFunction(country); // Get the hash value
     if (table->table[index] != NULL) // Check if the table is not NULL
     {
         printf("Total weight of parcels for %s: %d grams\n", country, calculateTotalWeight(table->table[index]));
@@ -394,13 +451,12 @@ void displayTotalForCountry(struct HashTable* table, const char* country) // Dis
 }
 
 /* Function: displayCheapestMostExpensive
-* Parameters : struct HashTable* table, const char* country
+* Parameters : struct HashTable* table, const char* country, unsigned long index
 * Description : displays the cheapest and most expensive parcels for a given country
 * Return value : void
 */
-void displayCheapestMostExpensive(struct HashTable* table, const char* country) // Display the cheapest and most expensive parcels for a given country
+void displayCheapestMostExpensive(struct HashTable* table, const char* country, unsigned long index) // Display the cheapest and most expensive parcels for a given country
 {
-    unsigned long index = hashFunction(country);
     if (table->table[index] != NULL) // Check if the table is not NULL
     {
         struct TreeNode* minNode = findMinValuation(table->table[index]); // Find the minimum valuation node
@@ -424,13 +480,12 @@ void displayCheapestMostExpensive(struct HashTable* table, const char* country)
 }
 
 /* Function: displayLightestHeaviest
-* Parameters : struct HashTable* table, const char* country
+* Parameters : struct HashTable* table, const char* country, unsigned long index
 * Description : displays the lightest and heaviest parcels for a given country
 * Return value : void
 */
-void displayLightestHeaviest(struct HashTable* table, const char* country)
+void displayLightestHeaviest(struct HashTable* table, const char* country, unsigned long index)
 {
-    unsigned long index = hashFunction(country); // Get the hash value
     if (table->table[index] != NULL) // Check if the table is not NULL
     {
         struct TreeNode* minNode = findMin(table->table[index]); // Find the minimum node
@@ -481,11 +536,11 @@ void loadParcelsFromFile(struct HashTable* table, const char* filename)
             printf("Error reading line\n");
             continue;
         }
-        // Trim trailing whitespace from destination name
-        int len = (int)strlen(destination); // Get the length of the destination string
-        if (len > 0 && destination[len - 1] == ' ') // Check if the last character is a space
+        trimWhitespace(destination); // Trim the destination name the same way typed names are trimmed
+        if (destination[0] == '\0')
         {
-            destination[len - 1] = '\0';
+            printf("Error reading line\n");
+            continue;
         }
         if (weight > MAX_WEIGHT)
         {
@@ -519,6 +574,567 @@ void loadParcelsFromFile(struct HashTable* table, const char* filename)
     }
 }
 
+/* Function: createTrieNode
+* Parameters : const char* edge, int edgeLength
+* Description : creates a new trie node whose incoming edge is the first edgeLength characters of edge, lowercased
+* Return value : TrieNode pointer
+*/
+struct TrieNode* createTrieNode(const char* edge, int edgeLength)
+{
+    struct TrieNode* newNode = (struct TrieNode*)malloc(sizeof(struct TrieNode)); // Allocate memory for the node
+    if (!newNode)
+    {
+        printf("Memory allocation failed\n");
+        return NULL;
+    }
+    newNode->edge = (char*)malloc(edgeLength + 1); // Allocate memory for the edge label
+    if (!newNode->edge)
+    {
+        printf("Memory allocation failed\n");
+        free(newNode);
+        return NULL;
+    }
+    for (int i = 0; i < edgeLength; i++)
+    {
+        newNode->edge[i] = (char)tolower((unsigned char)edge[i]); // Edges are stored lowercase for case-insensitive lookups
+    }
+    newNode->edge[edgeLength] = '\0';
+    newNode->edgeLength = edgeLength;
+    newNode->names = NULL;
+    newNode->child = newNode->sibling = NULL;
+    return newNode;
+}
+
+/* Function: insertCountry
+* Parameters : struct TrieNode* root, const char* name, unsigned long index
+* Description : adds a country name to the trie, splitting edges where the name diverges from an existing one.
+*               Names that only differ by case share a node, which keeps every spelling with its own hash table index.
+* Return value : int, 1 on success and 0 if memory allocation failed
+*/
+int insertCountry(struct TrieNode* root, const char* name, unsigned long index)
+{
+    struct TrieNode* node = root;
+    const char* key = name;
+    if (!node)
+    {
+        return 0;
+    }
+
+    while (*key)
+    {
+        char first = (char)tolower((unsigned char)*key);
+        struct TrieNode** link = &node->child; // Find the child starting with the next letter, keeping the siblings sorted
+        while (*link && (*link)->edge[0] < first)
+        {
+            link = &(*link)->sibling;
+        }
+        struct TrieNode* child = *link;
+
+        if (!child || child->edge[0] != first) // No edge shares the next letter, hang the rest of the name here
+        {
+            struct TrieNode* newNode = createTrieNode(key, (int)strlen(key));
+            if (!newNode)
+            {
+                return 0;
+            }
+            newNode->sibling = child;
+            *link = newNode;
+            node = newNode;
+            break;
+        }
+
+        int common = 0; // Length shared by the edge and the rest of the name
+        while (common < child->edgeLength && key[common] && tolower((unsigned char)key[common]) == child->edge[common])
+        {
+            common++;
+        }
+        if (common < child->edgeLength) // The name leaves the edge part way, split it in two
+        {
+            struct TrieNode* middle = createTrieNode(child->edge, common);
+            char* rest = (char*)malloc(child->edgeLength - common + 1);
+            if (!middle || !rest)
+            {
+                printf("Memory allocation failed\n");
+                freeTrie(middle);
+                free(rest);
+                return 0;
+            }
+            strcpy(rest, child->edge + common);
+            free(child->edge);
+            child->edge = rest;
+            child->edgeLength -= common;
+            middle->sibling = child->sibling;
+            middle->child = child;
+            child->sibling = NULL;
+            *link = middle;
+            child = middle;
+        }
+        node = child;
+        key += common;
+    }
+
+    struct CountryName** spelling = &node->names; // Add the spelling at the end of the list unless it is already there
+    while (*spelling)
+    {
+        if (strcmp((*spelling)->name, name) == 0)
+        {
+            return 1;
+        }
+        spelling = &(*spelling)->next;
+    }
+    struct CountryName* country = (struct CountryName*)malloc(sizeof(struct CountryName));
+    if (!country)
+    {
+        printf("Memory allocation failed\n");
+        return 0;
+    }
+    country->name = (char*)malloc(strlen(name) + 1);
+    if (!country->name)
+    {
+        printf("Memory allocation failed\n");
+        free(country);
+        return 0;
+    }
+    strcpy(country->name, name);
+    country->index = index;
+    country->next = NULL;
+    *spelling = country;
+    return 1;
+}
+
+/* Function: descendTrie
+* Parameters : struct TrieNode* root, const char* key, int allowPartial
+* Description : follows key down the trie ignoring case. When allowPartial is set the key may end part way through an edge,
+*               which is what a prefix search needs.
+* Return value : TrieNode pointer to the node reached, NULL if the key is not in the trie
+*/
+struct TrieNode* descendTrie(struct TrieNode* root, const char* key, int allowPartial)
+{
+    struct TrieNode* node = root;
+    while (node && *key)
+    {
+        char first = (char)tolower((unsigned char)*key);
+        struct TrieNode* child = node->child;
+        while (child && child->edge[0] < first) // Siblings are sorted, stop as soon as we pass the letter
+        {
+            child = child->sibling;
+        }
+        if (!child || child->edge[0] != first)
+        {
+            return NULL; // No edge for the next letter
+        }
+        int i = 0;
+        while (i < child->edgeLength && key[i])
+        {
+            if (tolower((unsigned char)key[i]) != child->edge[i])
+            {
+                return NULL; // The key leaves the edge
+            }
+            i++;
+        }
+        if (i < child->edgeLength && !allowPartial)
+        {
+            return NULL; // The key ended in the middle of an edge
+        }
+        node = child;
+        key += i;
+    }
+    return node;
+}
+
+/* Function: findCountryExact
+* Parameters : struct TrieNode* root, const char* name
+* Description : looks up a country name, matching case exactly against every spelling loaded
+* Return value : CountryName pointer, NULL if the country is not known
+*/
+struct CountryName* findCountryExact(struct TrieNode* root, const char* name)
+{
+    struct TrieNode* node = descendTrie(root, name, 0);
+    for (struct CountryName* country = node ? node->names : NULL; country; country = country->next)
+    {
+        if (strcmp(country->name, name) == 0)
+        {
+            return country;
+        }
+    }
+    return NULL;
+}
+
+/* Function: findCountryIgnoreCase
+* Parameters : struct TrieNode* root, const char* name
+* Description : looks up a country name ignoring case
+* Return value : CountryName pointer to the first spelling loaded, the other spellings follow it through next.
+*                NULL if the country is not known
+*/
+struct CountryName* findCountryIgnoreCase(struct TrieNode* root, const char* name)
+{
+    struct TrieNode* node = descendTrie(root, name, 0);
+    return node ? node->names : NULL;
+}
+
+/* Function: visitTrie
+* Parameters : struct TrieNode* node, void (*visit)(struct CountryName* country)
+* Description : calls visit for every country below node, in alphabetical order. Spellings of the same name are visited in load order.
+* Return value : int, number of countries visited
+*/
+int visitTrie(struct TrieNode* node, void (*visit)(struct CountryName* country))
+{
+    int count = 0;
+    if (node)
+    {
+        for (struct CountryName* country = node->names; country; country = country->next)
+        {
+            visit(country);
+            count++;
+        }
+        for (struct TrieNode* child = node->child; child; child = child->sibling)
+        {
+            count += visitTrie(child, visit);
+        }
+    }
+    return count;
+}
+
+/* Function: listCountriesWithPrefix
+* Parameters : struct TrieNode* root, const char* prefix, void (*visit)(struct CountryName* country)
+* Description : calls visit for every country starting with prefix (ignoring case), an empty prefix lists all of them
+* Return value : int, number of countries found
+*/
+int listCountriesWithPrefix(struct TrieNode* root, const char* prefix, void (*visit)(struct CountryName* country))
+{
+    return visitTrie(descendTrie(root, prefix, 1), visit);
+}
+
+/* Function: printCountry
+* Parameters : struct CountryName* country
+* Description : prints the name of a country from the trie
+* Return value : void
+*/
+void printCountry(struct CountryName* country)
+{
+    printf("%s\n", country->name);
+}
+
+/* Function: trimWhitespace
+* Parameters : char* text
+* Description : removes the leading and trailing whitespace of a string in place
+* Return value : void
+*/
+void trimWhitespace(char* text)
+{
+    char* start = text;
+    while (isspace((unsigned char)*start)) // Skip leading whitespace
+    {
+        start++;
+    }
+    int len = (int)strlen(start);
+    while (len > 0 && isspace((unsigned char)start[len - 1])) // Trim trailing whitespace
+    {
+        len--;
+    }
+    memmove(text, start, len);
+    text[len] = '\0';
+}
+
+/* Function: resolveCountry
+* Parameters : struct HashTable* table, const char* input, struct CountryName** first
+* Description : trims the surrounding whitespace off a country name typed by the user and finds it in the country index.
+*               An exact match gives that spelling only. Otherwise case is ignored and every spelling loaded is given,
+*               first points to the first one and the others follow it through next.
+* Return value : int, number of spellings found, 0 if the country is not known
+*/
+int resolveCountry(struct HashTable* table, const char* input, struct CountryName** first)
+{
+    char country[MAX_STRING] = { "" };
+    strncpy(country, input, MAX_STRING - 1);
+    trimWhitespace(country);
+
+    *first = findCountryExact(table->countries, country);
+    if (*first)
+    {
+        return 1;
+    }
+    int count = 0;
+    *first = findCountryIgnoreCase(table->countries, country);
+    for (struct CountryName* spelling = *first; spelling; spelling = spelling->next)
+    {
+        count++;
+    }
+    return count;
+}
+
+/* Function: slotShownBefore
+* Parameters : struct CountryName* first, struct CountryName* country
+* Description : tells if a spelling listed between first and country shares the hash table slot of country.
+*               That slot tree holds the parcels of both spellings, so it has already been displayed.
+* Return value : int, 1 if the slot was already shown, 0 otherwise
+*/
+int slotShownBefore(struct CountryName* first, struct CountryName* country)
+{
+    for (struct CountryName* spelling = first; spelling != country; spelling = spelling->next)
+    {
+        if (spelling->index == country->index)
+        {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/* Function: freeTrie
+* Parameters : struct TrieNode* root
+* Description : frees memory allocated for the trie
+* Return value : void
+*/
+void freeTrie(struct TrieNode* root)
+{
+    while (root)
+    {
+        struct TrieNode* next = root->sibling;
+        freeTrie(root->child); // Free the children
+        while (root->names) // Free the spellings
+        {
+            struct CountryName* spelling = root->names;
+            root->names = spelling->next;
+            free(spelling->name);
+            free(spelling);
+        }
+        free(root->edge);
+        free(root);
+        root = next; // Move on to the next sibling
+    }
+}
+
+/* Function: openCursor
+* Parameters : struct ParcelCursor* cursor, struct HashTable* table, const char* country, unsigned long index
+* Description : prepares a cursor over the parcels of a country, in order of weight, positioned on the lightest parcel
+* Return value : int, 1 on success and 0 if memory allocation failed
+*/
+int openCursor(struct ParcelCursor* cursor, struct HashTable* table, const char* country, unsigned long index)
+{
+    struct CursorToken start = { 0, 0 }; // Weights are never negative
+    return openCursorAt(cursor, table, country, index, start);
+}
+
+/* Function: openCursorAt
+* Parameters : struct ParcelCursor* cursor, struct HashTable* table, const char* country, unsigned long index, struct CursorToken token
+* Description : prepares a cursor over the parcels of a country, in order of weight, positioned where token points
+* Return value : int, 1 on success and 0 if memory allocation failed
+*/
+int openCursorAt(struct ParcelCursor* cursor, struct HashTable* table, const char* country, unsigned long index, struct CursorToken token)
+{
+    cursor->root = table->table[index];
+    cursor->country = country;
+    cursor->stack = NULL;
+    cursor->depth = 0;
+    cursor->capacity = 0;
+    cursor->failed = 0;
+    return resumeCursor(cursor, token);
+}
+
+/* Function: pushCursor
+* Parameters : struct ParcelCursor* cursor, struct TreeNode* node
+* Description : pushes a node on the cursor stack, growing the stack when it is full
+* Return value : int, 1 on success and 0 if memory allocation failed
+*/
+int pushCursor(struct ParcelCursor* cursor, struct TreeNode* node)
+{
+    if (cursor->depth == cursor->capacity)
+    {
+        int capacity = cursor->capacity ? cursor->capacity * 2 : 16;
+        struct TreeNode** stack = (struct TreeNode**)realloc(cursor->stack, capacity * sizeof(struct TreeNode*));
+        if (!stack)
+        {
+            printf("Memory allocation failed\n");
+            cursor->failed = 1;
+            return 0;
+        }
+        cursor->stack = stack;
+        cursor->capacity = capacity;
+    }
+    cursor->stack[cursor->depth++] = node;
+    return 1;
+}
+
+/* Function: seekCursor
+* Parameters : struct ParcelCursor* cursor, int weight
+* Description : positions the cursor on the first parcel weighing at least weight, in a single walk down the tree.
+*               Each node we go left from is kept on the stack, it is visited once its left subtree is done.
+* Return value : int, 1 on success and 0 if memory allocation failed
+*/
+int seekCursor(struct ParcelCursor* cursor, int weight)
+{
+    struct TreeNode* node = cursor->root;
+    cursor->depth = 0;
+    while (node)
+    {
+        if (node->parcel->weight >= weight)
+        {
+            if (!pushCursor(cursor, node))
+            {
+                return 0;
+            }
+            node = node->left; // Lighter parcels that still qualify are on the left
+        }
+        else
+        {
+            node = node->right; // Too light, so is everything on its left
+        }
+    }
+    return 1;
+}
+
+/* Function: peekParcel
+* Parameters : struct ParcelCursor* cursor
+* Description : moves past parcels of other countries sharing the hash slot and returns the next parcel without consuming it
+* Return value : Parcel pointer, NULL when there are no parcels left
+*/
+struct Parcel* peekParcel(struct ParcelCursor* cursor)
+{
+    while (cursor->depth > 0)
+    {
+        struct TreeNode* node = cursor->stack[cursor->depth - 1];
+        if (strcmp(node->parcel->destination, cursor->country) == 0)
+        {
+            return node->parcel;
+        }
+        if (!nextNode(cursor))
+        {
+            return NULL;
+        }
+    }
+    return NULL;
+}
+
+/* Function: nextNode
+* Parameters : struct ParcelCursor* cursor
+* Description : pops the node on top of the stack and pushes the left spine of its right subtree
+* Return value : int, 1 on success and 0 if memory allocation failed
+*/
+int nextNode(struct ParcelCursor* cursor)
+{
+    struct TreeNode* node = cursor->stack[--cursor->depth]->right;
+    while (node)
+    {
+        if (!pushCursor(cursor, node))
+        {
+            cursor->depth = 0; // Stop the cursor rather than skip parcels
+            return 0;
+        }
+        node = node->left;
+    }
+    return 1;
+}
+
+/* Function: nextParcel
+* Parameters : struct ParcelCursor* cursor
+* Description : returns the next parcel of the country and advances the cursor
+* Return value : Parcel pointer, NULL when there are no parcels left
+*/
+struct Parcel* nextParcel(struct ParcelCursor* cursor)
+{
+    struct Parcel* parcel = peekParcel(cursor);
+    if (parcel)
+    {
+        nextNode(cursor);
+    }
+    return parcel;
+}
+
+/* Function: advanceToken
+* Parameters : struct CursorToken* token, struct Parcel* parcel
+* Description : moves a token past a parcel the cursor has just returned
+* Return value : void
+*/
+void advanceToken(struct CursorToken* token, struct Parcel* parcel)
+{
+    if (parcel->weight == token->weight)
+    {
+        token->skip++; // One more parcel returned at the same weight
+    }
+    else
+    {
+        token->weight = parcel->weight;
+        token->skip = 1;
+    }
+}
+
+/* Function: resumeCursor
+* Parameters : struct ParcelCursor* cursor, struct CursorToken token
+* Description : positions the cursor right after the parcel a token was saved on.
+*               Parcels of equal weight are stored in insertion order, so skipping the ones already returned is enough.
+*               The skip costs one step per parcel, which adds up when many parcels are clamped to the same weight on load.
+* Return value : int, 1 on success and 0 if memory allocation failed
+*/
+int resumeCursor(struct ParcelCursor* cursor, struct CursorToken token)
+{
+    if (!seekCursor(cursor, token.weight))
+    {
+        return 0;
+    }
+    for (int i = 0; i < token.skip; i++)
+    {
+        struct Parcel* parcel = peekParcel(cursor);
+        if (!parcel || parcel->weight != token.weight)
+        {
+            break; // The parcels at that weight are already behind us
+        }
+        nextParcel(cursor);
+    }
+    return 1;
+}
+
+/* Function: closeCursor
+* Parameters : struct ParcelCursor* cursor
+* Description : frees memory allocated for the cursor stack
+* Return value : void
+*/
+void closeCursor(struct ParcelCursor* cursor)
+{
+    free(cursor->stack);
+    cursor->stack = NULL;
+    cursor->depth = cursor->capacity = 0;
+}
+
+/* Function: displayParcelPage
+* Parameters : struct HashTable* table, const char* country, unsigned long index, struct CursorToken* token, int offset, int limit, int* more
+* Description : prints at most limit parcels for a country, starting where token points and skipping offset parcels first.
+*               The token is moved past the skipped and printed parcels, and more is set if parcels remain after this page.
+*               The cost is one walk down the tree, plus the parcels already returned at the token weight, plus the parcels visited.
+*               The cursor stack holds up to the height of the tree, which is not balanced.
+* Return value : int, number of parcels printed, -1 if memory allocation failed and the page is incomplete
+*/
+int displayParcelPage(struct HashTable* table, const char* country, unsigned long index, struct CursorToken* token, int offset, int limit, int* more)
+{
+    struct ParcelCursor cursor;
+    struct Parcel* parcel = NULL;
+    int count = 0;
+    *more = 0;
+    if (!openCursorAt(&cursor, table, country, index, *token))
+    {
+        closeCursor(&cursor);
+        return -1;
+    }
+
+    for (int skipped = 0; skipped < offset && (parcel = nextParcel(&cursor)) != NULL; skipped++)
+    {
+        advanceToken(token, parcel); // Skipped parcels are not shown again on the next page
+    }
+    for (; count < limit && (parcel = nextParcel(&cursor)) != NULL; count++)
+    {
+        printf("Destination: %s, Weight: %d, Valuation: $%.2f\n", parcel->destination, parcel->weight, parcel->valuation);
+        advanceToken(token, parcel);
+    }
+    *more = peekParcel(&cursor) != NULL;
+    if (cursor.failed)
+    {
+        count = -1;
+        *more = 0;
+    }
+    closeCursor(&cursor);
+    return count;
+}
+
 /* Function: displayMenu
 * Parameters : struct HashTable* table
 * Description : displays the menu and handles user input
@@ -532,7 +1148,14 @@ void displayMenu(struct HashTable* table)
     int weight = 0;
     int isHigher = 0;
     char destination[MAX_STRING] = { "Undefined" };
-    TreeNode* parcelNode = NULL;
+    struct CountryName* match = NULL; // First spelling of the country found in the country index
+    int matches = 0; // Number of spellings found
+    struct CountryName* spelling = NULL; // Spelling being displayed
+    struct CursorToken token = { 0, 0 }; // Position in a paginated listing
+    int pageSize = 0;
+    int offset = 0; // Parcels skipped before the first page
+    int printed = 0; // Parcels printed on the last page, -1 if memory allocation failed
+    int more = 0; // Whether parcels remain after the page shown
 
     do 
     {
@@ -541,7 +1164,9 @@ void displayMenu(struct HashTable* table)
         printf("3. Display the total parcel load and valuation for the country\n");
         printf("4. Enter the country name and display cheapest and most expensive parcels details\n");
         printf("5. Enter the country name and display lightest and heaviest parcel for the country\n");
-        printf("6. Exit the application\n"); 
+        printf("6. Enter the start of a country name and list the matching countries\n");
+        printf("7. Enter country, minimum weight, parcels to skip and page size and page through the parcels\n");
+        printf("8. Exit the application\n"); 
         printf("Enter your choice: ");
         fgets(input, 21, stdin);
         choice = atoi(input);
@@ -552,15 +1177,19 @@ void displayMenu(struct HashTable* table)
             printf("Enter country name: ");
             fgets(country, MAX_STRING, stdin);
             country[strcspn(country, "\n")] = '\0'; // Remove newline character
-			parcelNode = searchParcel(table->table[hashFunction(country)], country);
-			if (parcelNode == NULL)
+            matches = resolveCountry(table, country, &match); // Trim and look the name up
+            if (matches == 0)
             { 
-				printf("No parcels found for %s.\n", country); // Print an error message
-			}
-			else
-			{
-				displayParcels(table, country);
-			}
+                printf("No parcels found for %s.\n", country); // Print an error message
+            }
+            spelling = match;
+            for (int i = 0; i < matches; i++, spelling = spelling->next) // Every spelling found
+            {
+                if (!slotShownBefore(match, spelling))
+                {
+                    displayParcels(table, spelling->name, spelling->index);
+                }
+            }
             break;
         case 2:
             printf("Enter country name: ");
@@ -569,59 +1198,135 @@ void displayMenu(struct HashTable* table)
             printf("Enter weight: ");
             fgets(input, 21, stdin);
             weight = atoi(input);
-			parcelNode = searchParcel(table->table[hashFunction(country)], country);
-			if (parcelNode == NULL)
-			{
-				printf("No parcels found for %s.\n", country); // Print an error message
-			}
-            else
+            matches = resolveCountry(table, country, &match); // Trim and look the name up
+            if (matches == 0)
+            {
+                printf("No parcels found for %s.\n", country); // Print an error message
+            }
+            spelling = match;
+            for (int i = 0; i < matches; i++, spelling = spelling->next) // Every spelling found
             {
-                searchWeightForCountry(table, country, weight);
+                if (!slotShownBefore(match, spelling))
+                {
+                    searchWeightForCountry(table, spelling->name, spelling->index, weight);
+                }
             }
             break;
         case 3:
             printf("Enter country name: ");
             fgets(country, MAX_STRING, stdin);
             country[strcspn(country, "\n")] = '\0'; // Remove newline character
-			parcelNode = searchParcel(table->table[hashFunction(country)], country);
-			if (parcelNode == NULL)
-			{
-				printf("No parcels found for %s.\n", country); // Print an error message
-			}
-			else
-			{
-				displayTotalForCountry(table, country);
-			}
+            matches = resolveCountry(table, country, &match); // Trim and look the name up
+            if (matches == 0)
+            {
+                printf("No parcels found for %s.\n", country); // Print an error message
+            }
+            spelling = match;
+            for (int i = 0; i < matches; i++, spelling = spelling->next) // Every spelling found
+            {
+                if (!slotShownBefore(match, spelling))
+                {
+                    displayTotalForCountry(table, spelling->name, spelling->index);
+                }
+            }
             break;
         case 4:
             printf("Enter country name: ");
             fgets(country, MAX_STRING, stdin);
             country[strcspn(country, "\n")] = '\0'; // Remove newline character
-			parcelNode = searchParcel(table->table[hashFunction(country)], country);
-			if (parcelNode == NULL)
-			{
-				printf("No parcels found for %s.\n", country); // Print an error message
-			}
-			else
-			{
-				displayCheapestMostExpensive(table, country);
-			}
+            matches = resolveCountry(table, country, &match); // Trim and look the name up
+            if (matches == 0)
+            {
+                printf("No parcels found for %s.\n", country); // Print an error message
+            }
+            spelling = match;
+            for (int i = 0; i < matches; i++, spelling = spelling->next) // Every spelling found
+            {
+                if (!slotShownBefore(match, spelling))
+                {
+                    displayCheapestMostExpensive(table, spelling->name, spelling->index);
+                }
+            }
             break;
         case 5:
             printf("Enter country name: ");
             fgets(country, MAX_STRING, stdin);
             country[strcspn(country, "\n")] = '\0'; // Remove newline character
-			parcelNode = searchParcel(table->table[hashFunction(country)], country);
-			if (parcelNode == NULL)
-			{
-				printf("No parcels found for %s.\n", country); // Print an error message
+            matches = resolveCountry(table, country, &match); // Trim and look the name up
+            if (matches == 0)
+            {
+                printf("No parcels found for %s.\n", country); // Print an error message
+            }
+            spelling = match;
+            for (int i = 0; i < matches; i++, spelling = spelling->next) // Every spelling found
+            {
+                if (!slotShownBefore(match, spelling))
+                {
+                    displayLightestHeaviest(table, spelling->name, spelling->index);
+                }
+            }
+            break;
+        case 6:
+            printf("Enter the start of the country name (leave empty to list all): ");
+            fgets(country, MAX_STRING, stdin);
+            country[strcspn(country, "\n")] = '\0'; // Remove newline character
+            trimWhitespace(country); // Trim the prefix like the country names
+            if (listCountriesWithPrefix(table->countries, country, printCountry) == 0)
+            {
+                printf("No countries start with %s.\n", country); // Print an error message
+            }
+            break;
+        case 7:
+            printf("Enter country name: ");
+            fgets(country, MAX_STRING, stdin);
+            country[strcspn(country, "\n")] = '\0'; // Remove newline character
+            printf("Enter minimum weight: ");
+            fgets(input, 21, stdin);
+            weight = atoi(input);
+            printf("Enter number of parcels to skip: ");
+            fgets(input, 21, stdin);
+            offset = atoi(input);
+            printf("Enter page size: ");
+            fgets(input, 21, stdin);
+            pageSize = atoi(input);
+            matches = resolveCountry(table, country, &match); // Trim and look the name up
+            if (matches == 0)
+            {
+                printf("No parcels found for %s.\n", country); // Print an error message
+                break;
             }
-			else
-			{
-				displayLightestHeaviest(table, country);    
+            if (pageSize <= 0 || offset < 0)
+            {
+                printf("Invalid page size or number of parcels to skip.\n");
+                break;
+            }
+            spelling = match;
+            for (int i = 0; i < matches; i++, spelling = spelling->next) // The cursor only returns parcels of one spelling
+            {
+                token.weight = weight;
+                token.skip = 0;
+                printf("Parcels for %s weighing at least %d:\n", spelling->name, weight);
+                printed = displayParcelPage(table, spelling->name, spelling->index, &token, offset, pageSize, &more);
+                if (printed == 0)
+                {
+                    printf("No parcels found for %s.\n", spelling->name); // Print an error message
+                }
+                while (printed > 0 && more) // Continue from the token until the user stops
+                {
+                    printf("Show next page? (y/n): ");
+                    if (fgets(input, 21, stdin) == NULL || (input[0] != 'y' && input[0] != 'Y'))
+                    {
+                        break;
+                    }
+                    printed = displayParcelPage(table, spelling->name, spelling->index, &token, 0, pageSize, &more);
+                }
+                if (printed < 0)
+                {
+                    printf("Listing stopped, memory allocation failed.\n"); // Print an error message
+                }
             }
             break;
-        case 6: // New case for searching a parcel by destination
+        case 8:
 			exit(0);
             break;
      
@@ -629,33 +1334,7 @@ void displayMenu(struct HashTable* table)
             printf("Invalid choice, please try again.\n");
             break;
         }
-    } while (choice != 6);
-}
-
-/* Function: searchParcel
- * Parameters: struct TreeNode* root, const char* destination
- * Description: searches for a parcel by its destination in the BST
- * Return value: TreeNode pointer
- */
-TreeNode* searchParcel(TreeNode* root, const char* destination) 
-{
-    if (root == NULL) 
-    {
-        return NULL; // Parcel not found
-    }
-    int comparison = strcmp(root->parcel->destination, destination);
-    if (comparison == 0) 
-    {
-        return root; // Parcel found
-    }
-    else if (comparison > 0) 
-    {
-        return searchParcel(root->left, destination); // Search in the left subtree
-    }
-    else 
-    {
-        return searchParcel(root->right, destination); // Search in the right subtree
-    }
+    } while (choice != 8);
 }
 
 // Main function
@@ -671,6 +1350,7 @@ int main(void)
     {
         freeMemory(table.table[i]); // Free memory for the BST
     }
+    freeTrie(table.countries); // Free memory for the country index
 
     return 0;
 }